@@ -33,7 +33,61 @@ static const char *_Anders_CompressionStrings[] =
     "-c:v libx264 -preset veryslow -crf 18"     // Size optimized
 };
 
-struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t height, uint8_t FPS, enum Anders_CompressionSetting compression)
+#define ANDERS_FILTER_BOX   0
+#define ANDERS_FILTER_TENT  1
+static const struct { uint8_t supersample; uint8_t filter; } _Anders_AntiAliasingSettings[] =
+{
+    { 1, ANDERS_FILTER_BOX },   // None
+    { 2, ANDERS_FILTER_BOX },   // 2x box
+    { 4, ANDERS_FILTER_BOX },   // 4x box
+    { 2, ANDERS_FILTER_TENT },  // 2x tent
+    { 4, ANDERS_FILTER_TENT }   // 4x tent
+};
+
+/*
+    Per axis filter taps for downsampling by a factor s, relative to the first
+    supersampled pixel (x * s) of an output pixel x
+
+    box:  s taps starting at 0, all weighted 1                      (sum s)
+    tent: 2s taps starting at -s/2, weighted 2s - |2k + 1 - 2s|     (sum 2s^2)
+          e.g. s = 2 gives 1 3 3 1
+
+    Both sums are powers of two for s = 2 and s = 4, so normalisation is a shift
+*/
+static void _Anders_ComputeAntiAliasingFilter(struct Anders *a, uint8_t filter)
+{
+    int32_t s = a->_supersample;
+
+    if(filter == ANDERS_FILTER_TENT && s > 1)
+    {
+        a->_AATaps = 2 * s;
+        a->_AATapOffset = -s / 2;
+        for(int32_t k = 0; k < a->_AATaps; k++)
+        {
+            a->_AAWeights[k] = 2 * s - abs(2 * k + 1 - 2 * s);
+        }
+    }
+    else
+    {
+        a->_AATaps = s;
+        a->_AATapOffset = 0;
+        for(int32_t k = 0; k < a->_AATaps; k++)
+        {
+            a->_AAWeights[k] = 1;
+        }
+    }
+
+    uint32_t sum = 0;
+    for(int32_t k = 0; k < a->_AATaps; k++)
+    {
+        sum += a->_AAWeights[k];
+    }
+
+    a->_AAShift = 0;
+    while((1u << a->_AAShift) < sum * sum) a->_AAShift++;
+}
+
+struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t height, uint8_t FPS, enum Anders_CompressionSetting compression, enum Anders_AntiAliasing antiAliasing)
 {
     printf("Are you sure \"%s\" is your desired output directory? The directory's content will be cleared! (y/N) ", outputDir);
     char response;
@@ -60,6 +114,11 @@ struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t heigh
     a->_width = width;
     a->_height = height;
     a->_outputDir = outputDir;
+
+    a->_supersample = _Anders_AntiAliasingSettings[antiAliasing].supersample;
+    a->_bufferWidth = a->_width * a->_supersample;
+    a->_bufferHeight = a->_height * a->_supersample;
+    _Anders_ComputeAntiAliasingFilter(a, _Anders_AntiAliasingSettings[antiAliasing].filter);
     sprintf(command, "ffmpeg -f rawvideo -pix_fmt bgr24 -s %ux%u -r %d -i - %s %s/anders.mp4",
                      a->_width, a->_height, a->_FPS,
                      _Anders_CompressionStrings[compression],
@@ -71,7 +130,7 @@ struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t heigh
         goto fail_ffmpeg;
     }
 
-    a->_pixels = (struct _Anders_pixel *)malloc(a->_width * a->_height * sizeof(struct _Anders_pixel));
+    a->_pixels = (struct _Anders_pixel *)malloc((size_t)a->_bufferWidth * a->_bufferHeight * sizeof(struct _Anders_pixel));
     if(NULL == a->_pixels)
     {
         printf("Failed to allocate memory for Anders' pixels\n");
@@ -80,6 +139,7 @@ struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t heigh
 
     a->BMPCount = 0;
     a->frame = 0;
+    a->_renditions = NULL;
 
     // Compute image header data
     uint32_t ROW_SIZE_IN_BYTES = a->_width * BYTES_PER_PIXEL;
@@ -131,8 +191,22 @@ struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t heigh
         goto fail_rawPixelBuffer;
     }
 
+    // Allocate memory for the vertically filtered supersampled row, padded on both sides for the tent filter
+    a->_AARowBuffer = NULL;
+    if(a->_supersample > 1)
+    {
+        a->_AARowBuffer = (uint16_t *)malloc((a->_bufferWidth + 2 * a->_supersample) * BYTES_PER_PIXEL * sizeof(uint16_t));
+        if(NULL == a->_AARowBuffer)
+        {
+            printf("Failed to allocate anti-aliasing row buffer.\n");
+            goto fail_AARowBuffer;
+        }
+    }
+
     return a;
 
+fail_AARowBuffer:
+    free(a->_rawPixelBuffer);
 fail_rawPixelBuffer:
     free(a->_DIBHeaderBytes);
 fail_DIBHeaderBytes:
@@ -146,30 +220,374 @@ fail_a:
     return NULL;
 };
 
+/*
+    Area averaging weights for resampling one axis from sourceSize down to targetSize.
+
+    Target index o covers the source interval [o * S / D, (o + 1) * S / D). Every
+    source index it overlaps gets a weight proportional to the overlap, rounded
+    cumulatively so that the weights of a target index sum to exactly 256. Target
+    indices with fewer taps than the widest one are padded with zero weights,
+    shifting the start back at the far edge so no tap reads outside the source.
+*/
+static void _Anders_ComputeResampleAxis(struct _Anders_ResampleAxis *axis, uint32_t sourceSize, uint32_t targetSize)
+{
+    const uint64_t S = sourceSize, D = targetSize;
+
+    axis->_taps = 0;
+    for(uint64_t o = 0; o < D; o++)
+    {
+        uint32_t first = (o * S) / D;
+        uint32_t last = ((o + 1) * S + D - 1) / D - 1;
+        if(last - first + 1 > axis->_taps) axis->_taps = last - first + 1;
+    }
+
+    for(uint64_t o = 0; o < D; o++)
+    {
+        uint64_t begin = o * S, end = (o + 1) * S; // In units of 1 / D source pixels
+        uint32_t first = begin / D;
+        uint32_t start = first;
+        if(start + axis->_taps > sourceSize) start = sourceSize - axis->_taps;
+
+        uint16_t *weights = &axis->_weights[o * axis->_taps];
+        memset(weights, 0, axis->_taps * sizeof(uint16_t));
+
+        uint32_t previous = 0;
+        for(uint64_t i = first; i * D < end; i++)
+        {
+            uint64_t boundary = (i + 1) * D < end ? (i + 1) * D : end;
+            uint32_t cumulative = ((boundary - begin) * 256 + S / 2) / S;
+            weights[i - start] = cumulative - previous;
+            previous = cumulative;
+        }
+
+        axis->_starts[o] = start;
+    }
+}
+
+/*
+    Picks the source of every rendition: the smallest larger rung that is at least
+    as wide and as tall, falling back to the video itself. Renditions are sorted
+    largest first, so each one is downscaled from the rung above it when possible.
+*/
+static void _Anders_ComputeCascade(struct Anders *a)
+{
+    for(struct Anders_Rendition *r = a->_renditions; NULL != r; r = r->_next)
+    {
+        r->_source = a->_rawPixelBuffer;
+        r->_sourceWidth = a->_width;
+        r->_sourceHeight = a->_height;
+        r->_sourceStride = a->_width * BYTES_PER_PIXEL + a->_PADDING_BYTES;
+
+        for(struct Anders_Rendition *s = a->_renditions; s != r; s = s->_next)
+        {
+            if(s->_width >= r->_width && s->_height >= r->_height)
+            {
+                r->_source = s->_rawPixelBuffer;
+                r->_sourceWidth = s->_width;
+                r->_sourceHeight = s->_height;
+                r->_sourceStride = s->_width * BYTES_PER_PIXEL;
+            }
+        }
+
+        _Anders_ComputeResampleAxis(&r->_horizontal, r->_sourceWidth, r->_width);
+        _Anders_ComputeResampleAxis(&r->_vertical, r->_sourceHeight, r->_height);
+    }
+}
+
+static void *_Anders_RenditionWriter(void *argument)
+{
+    struct Anders_Rendition *r = (struct Anders_Rendition *)argument;
+
+    pthread_mutex_lock(&r->_mutex);
+    for(;;)
+    {
+        while(!r->_pending && !r->_stop)
+        {
+            pthread_cond_wait(&r->_cond, &r->_mutex);
+        }
+        if(!r->_pending) break; // Stopped with nothing left to write
+
+        pthread_mutex_unlock(&r->_mutex);
+        size_t written = fwrite(r->_rawPixelBuffer, 1, r->_PIXEL_DATA_SIZE, r->_FFmpeg);
+        if(written != r->_PIXEL_DATA_SIZE)
+        {
+            printf("Failed to pipe full data to FFmpeg on frame %u of rendition %ux%u\n", r->frame, r->_width, r->_height);
+        }
+        pthread_mutex_lock(&r->_mutex);
+
+        r->frame++;
+        r->_pending = 0;
+        pthread_cond_broadcast(&r->_cond);
+    }
+    pthread_mutex_unlock(&r->_mutex);
+
+    return NULL;
+}
+
+static void _Anders_StopRendition(struct Anders_Rendition *r)
+{
+    if(!r->_running) return;
+
+    pthread_mutex_lock(&r->_mutex);
+    r->_stop = 1;
+    pthread_cond_broadcast(&r->_cond);
+    pthread_mutex_unlock(&r->_mutex);
+
+    pthread_join(r->_writer, NULL);
+    r->_running = 0;
+}
+
+static void _Anders_DestroyRendition(struct Anders_Rendition *r)
+{
+    _Anders_StopRendition(r);
+    if(NULL != r->_FFmpeg) pclose(r->_FFmpeg); // Not composed
+    pthread_cond_destroy(&r->_cond);
+    pthread_mutex_destroy(&r->_mutex);
+
+    free(r->_rawPixelBuffer);
+    free(r->_horizontal._starts);
+    free(r->_horizontal._weights);
+    free(r->_vertical._starts);
+    free(r->_vertical._weights);
+    free(r->_rowBuffer);
+    free(r);
+}
+
+struct Anders_Rendition *Anders_AddRendition(struct Anders *a, char *filename, uint32_t width, uint32_t height, enum Anders_CompressionSetting compression)
+{
+    if(a->frame > 0)
+    {
+        printf("Renditions must be added before the first frame\n");
+        return NULL;
+    }
+    if(strlen(filename) >= sizeof(((struct Anders_Rendition *)0)->_filename))
+    {
+        printf("Rendition filename \"%s\" is too long\n", filename);
+        return NULL;
+    }
+
+    // Two FFmpeg processes writing the same file would fail mid render
+    uint8_t duplicate = 0 == strcmp(filename, "anders.mp4");
+    for(struct Anders_Rendition *s = a->_renditions; NULL != s; s = s->_next)
+    {
+        if(0 == strcmp(filename, s->_filename)) duplicate = 1;
+    }
+    if(duplicate)
+    {
+        printf("Rendition filename \"%s\" is already in use\n", filename);
+        return NULL;
+    }
+    if(0 == width || 0 == height || width > a->_width || height > a->_height)
+    {
+        printf("Rendition %ux%u does not fit within %ux%u\n", width, height, a->_width, a->_height);
+        return NULL;
+    }
+
+    struct Anders_Rendition *r = (struct Anders_Rendition *)calloc(1, sizeof(struct Anders_Rendition));
+    if(NULL == r)
+    {
+        printf("Failed to allocate memory for rendition\n");
+        return NULL;
+    }
+    r->_width = width;
+    r->_height = height;
+    strcpy(r->_filename, filename);
+    r->_PIXEL_DATA_SIZE = width * height * BYTES_PER_PIXEL; // Piped directly, no row padding
+
+    // Sources are never larger than the video, which bounds the number of taps
+    uint32_t horizontalTaps = (a->_width + width - 1) / width + 1;
+    uint32_t verticalTaps = (a->_height + height - 1) / height + 1;
+
+    r->_rawPixelBuffer = (uint8_t *)malloc(r->_PIXEL_DATA_SIZE);
+    r->_horizontal._starts = (uint32_t *)malloc(width * sizeof(uint32_t));
+    r->_horizontal._weights = (uint16_t *)malloc(width * horizontalTaps * sizeof(uint16_t));
+    r->_vertical._starts = (uint32_t *)malloc(height * sizeof(uint32_t));
+    r->_vertical._weights = (uint16_t *)malloc(height * verticalTaps * sizeof(uint16_t));
+    r->_rowBuffer = (uint16_t *)malloc(a->_width * BYTES_PER_PIXEL * sizeof(uint16_t));
+    if(NULL == r->_rawPixelBuffer || NULL == r->_horizontal._starts || NULL == r->_horizontal._weights ||
+       NULL == r->_vertical._starts || NULL == r->_vertical._weights || NULL == r->_rowBuffer)
+    {
+        printf("Failed to allocate buffers for rendition %ux%u\n", width, height);
+        goto fail_buffers;
+    }
+
+    char command[0xff << 2];
+    sprintf(command, "ffmpeg -f rawvideo -pix_fmt bgr24 -s %ux%u -r %d -i - %s %s/%s",
+                     r->_width, r->_height, a->_FPS,
+                     _Anders_CompressionStrings[compression],
+                     a->_outputDir, r->_filename);
+    r->_FFmpeg = popen(command, "w");
+    if(NULL == r->_FFmpeg)
+    {
+        printf("Failed to open pipe to FFmpeg for rendition %ux%u\n", width, height);
+        goto fail_buffers;
+    }
+
+    pthread_mutex_init(&r->_mutex, NULL);
+    pthread_cond_init(&r->_cond, NULL);
+    if(0 != pthread_create(&r->_writer, NULL, _Anders_RenditionWriter, r))
+    {
+        printf("Failed to start writer thread for rendition %ux%u\n", width, height);
+        pclose(r->_FFmpeg);
+        pthread_cond_destroy(&r->_cond);
+        pthread_mutex_destroy(&r->_mutex);
+        goto fail_buffers;
+    }
+    r->_running = 1;
+
+    // Insert largest first
+    struct Anders_Rendition **link = &a->_renditions;
+    while(NULL != *link && (uint64_t)(*link)->_width * (*link)->_height >= (uint64_t)width * height)
+    {
+        link = &(*link)->_next;
+    }
+    r->_next = *link;
+    *link = r;
+
+    _Anders_ComputeCascade(a);
+
+    return r;
+
+fail_buffers:
+    free(r->_rawPixelBuffer);
+    free(r->_horizontal._starts);
+    free(r->_horizontal._weights);
+    free(r->_vertical._starts);
+    free(r->_vertical._weights);
+    free(r->_rowBuffer);
+    free(r);
+    return NULL;
+}
+
 void Anders_Destroy(struct Anders *a)
 {
     if(NULL == a) return;
 
+    while(NULL != a->_renditions)
+    {
+        struct Anders_Rendition *next = a->_renditions->_next;
+        _Anders_DestroyRendition(a->_renditions);
+        a->_renditions = next;
+    }
+
     free(a->_pixels);
     free(a->_BMPHeaderBytes);
     free(a->_DIBHeaderBytes);
     free(a->_rawPixelBuffer);
+    free(a->_AARowBuffer);
     free(a);
 }
 
 void Anders_Clear(struct Anders *a, uint8_t r, uint8_t g, uint8_t b)
 {
     struct _Anders_pixel targetPixel = { .r = r, .g = g, .b = b };
-    for(size_t i = 0; i < a->_width * a->_height; i++)
+    for(size_t i = 0; i < (size_t)a->_bufferWidth * a->_bufferHeight; i++)
     {
         a->_pixels[i] = targetPixel;
     }
 }
 
+/*
+    Maps an output coordinate to the center of its pixel in the supersampled buffer.
+
+    Output pixel v spans [v * s, (v + 1) * s) in the buffer, which is also how
+    rectangles are scaled, so its center lies at (v + 0.5) * s. Rasterizers sample
+    buffer pixels at their centers px + 0.5, so the center is returned in pixel
+    index units, (v + 0.5) * s - 0.5, which is v itself without supersampling.
+*/
+static inline float _Anders_ToBuffer(struct Anders *a, uint16_t v)
+{
+    return (v + 0.5f) * a->_supersample - 0.5f;
+}
+
 #define TOP_TO_BOTTOM   0
 #define BOTTOM_TO_TOP   1
+/*
+    Filters the supersampled pixels down to the output resolution while writing
+    them to the raw pixel buffer, so no full resolution intermediate is needed.
+
+    Each output row is filtered vertically into a row of 16 bit channel sums and
+    then horizontally into the raw buffer. The vertical pass runs over plain
+    contiguous bytes so that it vectorizes. The row is padded with copies of its
+    edge pixels so that the horizontal pass needs no bounds checks.
+*/
+static void _Anders_DownsampleRawPixelBuffer(struct Anders *a, uint8_t order)
+{
+    const int32_t s = a->_supersample;
+    const int32_t taps = a->_AATaps;
+    const int32_t offset = a->_AATapOffset;
+    const uint16_t *weights = a->_AAWeights;
+    const uint32_t shift = a->_AAShift;
+    const uint32_t rounding = (1u << shift) >> 1;
+
+    const size_t rowBytes = (size_t)a->_bufferWidth * BYTES_PER_PIXEL;
+    const size_t padBytes = (size_t)s * BYTES_PER_PIXEL;
+    uint16_t *row = a->_AARowBuffer + padBytes;
+
+    uint8_t *pixelPointer = a->_rawPixelBuffer;
+    for(int32_t y = a->_height - 1; y >= 0; y--) // BMP stores data bottom up
+    {
+        int32_t outputY = (order == TOP_TO_BOTTOM ? (int32_t)a->_height - 1 - y : y);
+
+        // Vertical pass
+        memset(row, 0, rowBytes * sizeof(uint16_t));
+        for(int32_t k = 0; k < taps; k++)
+        {
+            int32_t sourceY = outputY * s + offset + k;
+            if(sourceY < 0) sourceY = 0;
+            if(sourceY >= (int32_t)a->_bufferHeight) sourceY = a->_bufferHeight - 1;
+
+            const uint8_t *restrict source = (const uint8_t *)&a->_pixels[(size_t)sourceY * a->_bufferWidth];
+            uint16_t *restrict sums = row;
+            const uint16_t weight = weights[k];
+            for(size_t i = 0; i < rowBytes; i++)
+            {
+                sums[i] += weight * source[i];
+            }
+        }
+
+        // Replicate edge pixels into the padding
+        for(size_t i = 0; i < padBytes; i++)
+        {
+            a->_AARowBuffer[i] = row[i % BYTES_PER_PIXEL];
+            row[rowBytes + i] = row[rowBytes - BYTES_PER_PIXEL + i % BYTES_PER_PIXEL];
+        }
+
+        // Horizontal pass
+        for(uint32_t x = 0; x < a->_width; x++)
+        {
+            const uint16_t *sums = &row[((int32_t)x * s + offset) * BYTES_PER_PIXEL];
+            uint32_t r = rounding, g = rounding, b = rounding;
+            for(int32_t k = 0; k < taps; k++)
+            {
+                r += weights[k] * sums[k * BYTES_PER_PIXEL + 0];
+                g += weights[k] * sums[k * BYTES_PER_PIXEL + 1];
+                b += weights[k] * sums[k * BYTES_PER_PIXEL + 2];
+            }
+
+            // Write normalised bytes for pixels
+            *pixelPointer++ = b >> shift;
+            *pixelPointer++ = g >> shift;
+            *pixelPointer++ = r >> shift;
+        }
+
+        // Pad if needed
+        if(a->_PADDING_BYTES > 0)
+        {
+            memcpy(pixelPointer, PADDING, a->_PADDING_BYTES);
+            pixelPointer += a->_PADDING_BYTES;
+        }
+    }
+}
+
 static void _Anders_PrepareRawPixelBuffer(struct Anders *a, uint8_t order)
 {
+    if(a->_supersample > 1)
+    {
+        _Anders_DownsampleRawPixelBuffer(a, order);
+        return;
+    }
+
     uint8_t *pixelPointer = a->_rawPixelBuffer;
     for(int32_t y = a->_height - 1; y >= 0; y--) // BMP stores data bottom up
     {
@@ -194,9 +612,87 @@ static void _Anders_PrepareRawPixelBuffer(struct Anders *a, uint8_t order)
     }
 }
 
+/*
+    Resamples the source rung of a rendition into its raw pixel buffer. Like the
+    anti-aliasing downsample, the vertical pass accumulates whole source rows of
+    bytes into 16 bit sums so that it vectorizes, and the horizontal pass then
+    weighs those sums per pixel. Channel order is irrelevant, so rungs stay bgr24.
+*/
+static void _Anders_ResampleRendition(struct Anders_Rendition *r)
+{
+    const size_t rowBytes = (size_t)r->_sourceWidth * BYTES_PER_PIXEL;
+    const uint32_t horizontalTaps = r->_horizontal._taps;
+    const uint32_t verticalTaps = r->_vertical._taps;
+    uint16_t *row = r->_rowBuffer;
+
+    uint8_t *pixelPointer = r->_rawPixelBuffer;
+    for(uint32_t y = 0; y < r->_height; y++)
+    {
+        // Vertical pass
+        const uint16_t *verticalWeights = &r->_vertical._weights[(size_t)y * verticalTaps];
+        memset(row, 0, rowBytes * sizeof(uint16_t));
+        for(uint32_t k = 0; k < verticalTaps; k++)
+        {
+            const uint16_t weight = verticalWeights[k];
+            if(0 == weight) continue;
+
+            const uint8_t *restrict source = r->_source + (size_t)(r->_vertical._starts[y] + k) * r->_sourceStride;
+            uint16_t *restrict sums = row;
+            for(size_t i = 0; i < rowBytes; i++)
+            {
+                sums[i] += weight * source[i];
+            }
+        }
+
+        // Horizontal pass
+        for(uint32_t x = 0; x < r->_width; x++)
+        {
+            const uint16_t *horizontalWeights = &r->_horizontal._weights[(size_t)x * horizontalTaps];
+            const uint16_t *sums = &row[(size_t)r->_horizontal._starts[x] * BYTES_PER_PIXEL];
+            uint32_t c0 = 1u << 15, c1 = 1u << 15, c2 = 1u << 15;
+            for(uint32_t k = 0; k < horizontalTaps; k++)
+            {
+                c0 += horizontalWeights[k] * sums[k * BYTES_PER_PIXEL + 0];
+                c1 += horizontalWeights[k] * sums[k * BYTES_PER_PIXEL + 1];
+                c2 += horizontalWeights[k] * sums[k * BYTES_PER_PIXEL + 2];
+            }
+
+            *pixelPointer++ = c0 >> 16;
+            *pixelPointer++ = c1 >> 16;
+            *pixelPointer++ = c2 >> 16;
+        }
+    }
+}
+
+/*
+    Produces every rendition from the freshly prepared raw pixel buffer, largest
+    first so that each rung is ready before the smaller ones read it. A rendition
+    is only overwritten once its writer has piped the previous frame.
+*/
+static void _Anders_CascadeRenditions(struct Anders *a)
+{
+    for(struct Anders_Rendition *r = a->_renditions; NULL != r; r = r->_next)
+    {
+        pthread_mutex_lock(&r->_mutex);
+        while(r->_pending)
+        {
+            pthread_cond_wait(&r->_cond, &r->_mutex);
+        }
+        pthread_mutex_unlock(&r->_mutex);
+
+        _Anders_ResampleRendition(r);
+
+        pthread_mutex_lock(&r->_mutex);
+        r->_pending = 1;
+        pthread_cond_broadcast(&r->_cond);
+        pthread_mutex_unlock(&r->_mutex);
+    }
+}
+
 void Anders_Frame(struct Anders *a)
 {   
     _Anders_PrepareRawPixelBuffer(a, TOP_TO_BOTTOM);
+    _Anders_CascadeRenditions(a);
 
     size_t written = fwrite(a->_rawPixelBuffer, 1, a->_PIXEL_DATA_SIZE, a->_FFmpeg);
     if(written != a->_PIXEL_DATA_SIZE)
@@ -264,10 +760,15 @@ void Anders_SaveAsBMP(struct Anders *a)
 void Anders_Rectangle(struct Anders *a, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t r, uint8_t g, uint8_t b)
 {
     struct _Anders_pixel targetPixel = { .r = r, .g = g, .b = b };
-    for(size_t _y = y; _y < y + height; _y++)
+
+    size_t s = a->_supersample;
+    size_t x0 = x * s, y0 = y * s;
+    size_t x1 = (x + width) * s, y1 = (y + height) * s; // Scale to the supersampled buffer
+
+    for(size_t _y = y0; _y < y1; _y++)
     {
-        size_t startIndex = _y * a->_width;
-        for(size_t _x = x; _x < x + width; _x++)
+        size_t startIndex = _y * a->_bufferWidth;
+        for(size_t _x = x0; _x < x1; _x++)
         {
             a->_pixels[startIndex + _x] = targetPixel;
         }   
@@ -282,47 +783,73 @@ void Anders_Compose(struct Anders *a)
         printf("FFmpeg failed to compose video\n");
     }
 
+    for(struct Anders_Rendition *r = a->_renditions; NULL != r; r = r->_next)
+    {
+        _Anders_StopRendition(r); // Flushes the last frame
+        status = pclose(r->_FFmpeg);
+        r->_FFmpeg = NULL;
+        if(status != 0)
+        {
+            printf("FFmpeg failed to compose rendition \"%s\"\n", r->_filename);
+        }
+    }
+
     return;
 }
 
 void Anders_Circle(struct Anders *a, uint16_t x, uint16_t y, uint16_t radius, uint8_t r, uint8_t g, uint8_t b)
 {
-    uint32_t r2 = radius * radius;
-
     struct _Anders_pixel targetPixel = { .r = r, .g = g, .b = b };
 
-    for(int32_t _x = -radius; _x <= radius; _x++)
+    // Work in doubled units so that the center from _Anders_ToBuffer stays integral
+    int64_t s = a->_supersample;
+    int64_t cx2 = (2 * (int64_t)x + 1) * s - 1;
+    int64_t cy2 = (2 * (int64_t)y + 1) * s - 1;
+
+    // Without supersampling pixels whose center lies within radius are filled, so the
+    // disc reaches radius + 0.5 pixels from the center. Supersampled discs use that extent
+    int64_t extent2 = (s == 1 ? 2 * (int64_t)radius : (2 * (int64_t)radius + 1) * s);
+    int64_t r2 = extent2 * extent2;
+
+    // Clip the bounding box to the buffer
+    int64_t xMin = cx2 - extent2 <= 0 ? 0 : (cx2 - extent2 + 1) / 2;
+    int64_t yMin = cy2 - extent2 <= 0 ? 0 : (cy2 - extent2 + 1) / 2;
+    int64_t xMax = (cx2 + extent2) / 2;
+    int64_t yMax = (cy2 + extent2) / 2;
+    if(xMax >= a->_bufferWidth) xMax = a->_bufferWidth - 1;
+    if(yMax >= a->_bufferHeight) yMax = a->_bufferHeight - 1;
+
+    for(int64_t py = yMin; py <= yMax; py++)
     {
-        uint32_t x2 = _x * _x;
+        int64_t dy = 2 * py - cy2;
+        int64_t y2 = dy * dy;
 
-        for(int32_t _y = -radius; _y <= radius; _y++)
+        size_t startIndex = (size_t)py * a->_bufferWidth;
+        for(int64_t px = xMin; px <= xMax; px++)
         {
-            int32_t px = x + _x;
-            int32_t py = y + _y;
+            int64_t dx = 2 * px - cx2;
 
-            if (x2 + (_y * _y) <= r2 &&
-                px >= 0 && px < a->_width &&
-                py >= 0 && py < a->_height)
+            if(dx * dx + y2 <= r2)
             {
-                a->_pixels[px + py * a->_width] = targetPixel;
+                a->_pixels[startIndex + px] = targetPixel;
             }
         }
     }
 }
 
-static void _Anders_DrawFlatTrianglePart(struct Anders *a, int y_start, int y_end,
-                                       int x_a_start, int y_a_start, int x_a_end, int y_a_end,
-                                       int x_b_start, int y_b_start, int x_b_end, int y_b_end,
+static void _Anders_DrawFlatTrianglePart(struct Anders *a, float y_start, float y_end,
+                                       float x_a_start, float y_a_start, float x_a_end, float y_a_end,
+                                       float x_b_start, float y_b_start, float x_b_end, float y_b_end,
                                        struct _Anders_pixel targetPixel)
 {   
-    float h_a = (float)(y_a_end - y_a_start);
-    float h_b = (float)(y_b_end - y_b_start);
+    float h_a = y_a_end - y_a_start;
+    float h_b = y_b_end - y_b_start;
     if(h_a == 0.0f || h_b == 0.0f) return; // Check that the triangle is valid
 
-    // Loop through all scanlines in this part
-    for(int y = y_start; y < y_end; y++)
+    // Loop through all scanlines whose pixel centers lie in this part
+    for(int y = (int)ceilf(y_start); y < (int)ceilf(y_end); y++)
     {
-        if(y < 0 || y >= a->_height) continue; // Prevent drawing outside the screen
+        if(y < 0 || y >= (int)a->_bufferHeight) continue; // Prevent drawing outside the screen
 
         float t_a = (float)(y - y_a_start) / h_a;
         float t_b = (float)(y - y_b_start) / h_b;
@@ -330,14 +857,24 @@ static void _Anders_DrawFlatTrianglePart(struct Anders *a, int y_start, int y_en
         float x_a = x_a_start + (x_a_end - x_a_start) * t_a;
         float x_b = x_b_start + (x_b_end - x_b_start) * t_b; // Interpolation
 
-        int xLeft = (int)fminf(x_a, x_b);
-        int xRight = (int)fmaxf(x_a, x_b);
+        float xLeft = fminf(x_a, x_b);
+        float xRight = fmaxf(x_a, x_b);
+        if(a->_supersample > 1)
+        {
+            xLeft = ceilf(xLeft);
+            xRight = floorf(xRight); // Pixels whose centers lie on the span
+        }
+        else
+        {
+            xLeft = truncf(xLeft);
+            xRight = truncf(xRight); // Aliased output keeps its original span rule
+        }
         
-        xLeft = (int)fmaxf(0, xLeft);
-        xRight = (int)fminf(a->_width - 1, xRight); // Compute left and right x coordinate for current scan line
+        xLeft = fmaxf(0, xLeft);
+        xRight = fminf(a->_bufferWidth - 1, xRight); // Compute left and right x coordinate for current scan line
         
-        size_t startIndex = (size_t)y * a->_width;
-        for (int x = xLeft; x <= xRight; x++)
+        size_t startIndex = (size_t)y * a->_bufferWidth;
+        for (int x = (int)xLeft; x <= (int)xRight; x++)
         {
             a->_pixels[startIndex + x] = targetPixel; // Rasterize line
         }
@@ -347,33 +884,34 @@ void Anders_Triangle(struct Anders *a, uint16_t x1, uint16_t y1, uint16_t x2, ui
 {
     struct _Anders_pixel targetPixel = { .r = r, .g = g, .b = b };
 
-    int vx[3] = { (int)x1, (int)x2, (int)x3 };
-    int vy[3] = { (int)y1, (int)y2, (int)y3 };
+    float vx[3] = { _Anders_ToBuffer(a, x1), _Anders_ToBuffer(a, x2), _Anders_ToBuffer(a, x3) };
+    float vy[3] = { _Anders_ToBuffer(a, y1), _Anders_ToBuffer(a, y2), _Anders_ToBuffer(a, y3) }; // Scale to the supersampled buffer
 
     // Ensure v0 is the smallest number
     if(vy[0] > vy[1])
     {
-        int ty = vy[0]; vy[0] = vy[1]; vy[1] = ty;
-        int tx = vx[0]; vx[0] = vx[1]; vx[1] = tx;
+        float ty = vy[0]; vy[0] = vy[1]; vy[1] = ty;
+        float tx = vx[0]; vx[0] = vx[1]; vx[1] = tx;
     }
 
     if(vy[0] > vy[2])
     {
-        int ty = vy[0]; vy[0] = vy[2]; vy[2] = ty;
-        int tx = vx[0]; vx[0] = vx[2]; vx[2] = tx;
+        float ty = vy[0]; vy[0] = vy[2]; vy[2] = ty;
+        float tx = vx[0]; vx[0] = vx[2]; vx[2] = tx;
     }
 
     // Sort v1 and v2
     if(vy[1] > vy[2])
     {
-        int ty = vy[1]; vy[1] = vy[2]; vy[2] = ty;
-        int tx = vx[1]; vx[1] = vx[2]; vx[2] = tx;
+        float ty = vy[1]; vy[1] = vy[2]; vy[2] = ty;
+        float tx = vx[1]; vx[1] = vx[2]; vx[2] = tx;
     }
 
     if(vy[0] == vy[2]) return; // Since v0 <= v1 <= v2, if y0 == y1 then the triangle is flat
     
-    float tSplit = (float)(vy[1] - vy[0]) / (vy[2] - vy[0]);
-    int xSplit = (int)(vx[0] + (vx[2] - vx[0]) * tSplit);
+    float tSplit = (vy[1] - vy[0]) / (vy[2] - vy[0]);
+    float xSplit = vx[0] + (vx[2] - vx[0]) * tSplit;
+    if(a->_supersample == 1) xSplit = truncf(xSplit);
 
     // Rasterize top half (0, 1, split)
     if(vy[0] != vy[1])
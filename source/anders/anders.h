@@ -2,15 +2,57 @@
 #define ANDERS_H
 
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <pthread.h>
 
 struct _Anders_pixel
 {
     uint8_t r, g, b;
 };
 
+struct _Anders_ResampleAxis
+{
+    uint32_t *_starts;  // First source index per target index
+    uint16_t *_weights; // _taps weights per target index, summing to 256
+    uint32_t _taps;
+};
+
+struct Anders_Rendition
+{
+    // public
+    uint32_t frame;
+
+    // private
+    uint32_t _width;
+    uint32_t _height;
+    char _filename[0xff];
+    FILE *_FFmpeg;
+    uint8_t *_rawPixelBuffer;
+    uint32_t _PIXEL_DATA_SIZE;
+
+    // Cascade
+    const uint8_t *_source;
+    uint32_t _sourceWidth;
+    uint32_t _sourceHeight;
+    uint32_t _sourceStride;
+    struct _Anders_ResampleAxis _horizontal;
+    struct _Anders_ResampleAxis _vertical;
+    uint16_t *_rowBuffer;
+
+    // Writer thread
+    pthread_t _writer;
+    pthread_mutex_t _mutex;
+    pthread_cond_t _cond;
+    uint8_t _pending;
+    uint8_t _stop;
+    uint8_t _running;
+
+    struct Anders_Rendition *_next;
+};
+
 struct Anders
 {
     // public
@@ -21,6 +63,8 @@ struct Anders
     struct _Anders_pixel *_pixels;
     uint32_t _width;
     uint32_t _height;
+    uint32_t _bufferWidth;
+    uint32_t _bufferHeight;
     uint8_t _FPS;
     char *_outputDir;
     FILE *_FFmpeg;
@@ -31,6 +75,17 @@ struct Anders
     uint8_t *_rawPixelBuffer;
     uint32_t _PIXEL_DATA_SIZE;
     uint32_t _PADDING_BYTES;
+
+    // Anti-aliasing
+    uint8_t _supersample;
+    uint8_t _AATaps;
+    int8_t _AATapOffset;
+    uint8_t _AAShift;
+    uint16_t _AAWeights[8];
+    uint16_t *_AARowBuffer;
+
+    // Renditions, largest first
+    struct Anders_Rendition *_renditions;
 };
 
 enum Anders_CompressionSetting
@@ -41,6 +96,15 @@ enum Anders_CompressionSetting
     ANDERS_COMPRESSION_SIZE_OPTIMIZED = 3
 };
 
+enum Anders_AntiAliasing
+{
+    ANDERS_ANTIALIASING_NONE = 0,
+    ANDERS_ANTIALIASING_2X_BOX = 1,
+    ANDERS_ANTIALIASING_4X_BOX = 2,
+    ANDERS_ANTIALIASING_2X_TENT = 3,
+    ANDERS_ANTIALIASING_4X_TENT = 4
+};
+
 /**
  * @brief Initialises the Anders drawing context
  * 
@@ -48,11 +112,28 @@ enum Anders_CompressionSetting
  * @param width Video width
  * @param height Video height
  * @param FPS Video framerate
+ * @param compression FFmpeg encoder setting
+ * @param antiAliasing Supersampling factor and downsampling filter. Drawing happens at
+ *                     the supersampled resolution, only the final resolution is piped
  * @return `struct Anders*`: A pointer towards to an Anders drawing context
  */
-struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t height, uint8_t FPS, enum Anders_CompressionSetting compression);
+struct Anders *Anders_Initialise(char *outputDir, uint32_t width, uint32_t height, uint8_t FPS, enum Anders_CompressionSetting compression, enum Anders_AntiAliasing antiAliasing);
+/**
+ * @brief Adds a lower resolution rendition of the video, encoded to its own file.
+ *        Every rendition is downscaled from the next larger one each frame and piped
+ *        to FFmpeg on its own writer thread. Must be called before the first frame.
+ * 
+ * @param a A pointer to the current Anders drawing context
+ * @param filename Output file inside the output directory, unique among the video and its renditions
+ * @param width Rendition width, at most the video width
+ * @param height Rendition height, at most the video height
+ * @param compression FFmpeg encoder setting
+ * @return `struct Anders_Rendition*`: A pointer to the rendition, owned by the drawing context
+ */
+struct Anders_Rendition *Anders_AddRendition(struct Anders *a, char *filename, uint32_t width, uint32_t height, enum Anders_CompressionSetting compression);
 /**
- * @brief Destroys the current Anders drawing context
+ * @brief Destroys the current Anders drawing context. Renditions that were not
+ *        composed have their writer threads stopped and their FFmpeg pipes closed
  * 
  * @param a A pointer to the current Anders drawing context
  */
@@ -109,7 +190,7 @@ void Anders_Circle(struct Anders *a, uint16_t x, uint16_t y, uint16_t radius, ui
 void Anders_Triangle(struct Anders *a, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint8_t r, uint8_t g, uint8_t b);
 
 /**
- * @brief Pipes current frame data to FFmpeg
+ * @brief Pipes current frame data to FFmpeg, for the video and all of its renditions
  * 
  * @param a A pointer to the current Anders drawing context
  */
@@ -121,7 +202,8 @@ void Anders_Frame(struct Anders *a);
  */
 void Anders_SaveAsBMP(struct Anders *a);
 /**
- * @brief Pieces together video shards and remaining unsharded frames
+ * @brief Pieces together video shards and remaining unsharded frames. Also waits for
+ *        every rendition's writer thread to pipe its last frame, then closes its FFmpeg pipe
  * 
  * @param a A pointer to the current Anders drawing context
  */
@@ -5,7 +5,7 @@
 
 int main(void)
 {
-    struct Anders *a = Anders_Initialise("render/", 400, 300, 60, ANDERS_COMPRESSION_SPEED_OPTIMIZED);
+    struct Anders *a = Anders_Initialise("render/", 400, 300, 60, ANDERS_COMPRESSION_SPEED_OPTIMIZED, ANDERS_ANTIALIASING_NONE);
     if(NULL == a)
     {
         return 1;